@@ -127,6 +127,26 @@ CG_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
 CG_EXTERN CGRect CGRectApplyAffineTransform(CGRect rect, CGAffineTransform t)
 CG_AVAILABLE_STARTING(__MAC_10_4, __IPHONE_2_0);
 
+/*
+ 批量变换大量的点或矩形时：
+ 1、CGPointApplyAffineTransform是下面定义的内联函数，放在循环里不会产生函数调用，
+ 但可以在循环外先判断一次t的类型，再选择更简单的循环：
+     if (CGAffineTransformIsIdentity(t)) {
+         //不需要变换
+     } else if (t.b == 0 && t.c == 0) {
+         //只有缩放和平移：x' = a*x + tx，y' = d*y + ty，省掉一半的乘法
+         for (size_t i = 0; i < n; i++) {
+             pts[i].x = t.a * pts[i].x + t.tx;
+             pts[i].y = t.d * pts[i].y + t.ty;
+         }
+     } else {
+         for (size_t i = 0; i < n; i++) pts[i] = CGPointApplyAffineTransform(pts[i], t);
+     }
+ 2、CGRectApplyAffineTransform要变换四个顶点再取包围盒；对于有限的矩形，当t.b == 0 && t.c == 0时结果等于
+ CGRectStandardize(CGRectMake(a*x + tx, d*y + ty, a*width, d*height))，只需要计算一个顶点和尺寸。
+ CGRectNull和CGRectInfinite不适用这个公式（会得到-inf、NaN或者溢出），需要先把它们剔除，单独调用CGRectApplyAffineTransform。
+ */
+
 /*** Definitions of inline functions. ***/
 
 CG_INLINE CGAffineTransform
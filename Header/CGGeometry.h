@@ -15,6 +15,13 @@ CF_IMPLICIT_BRIDGING_ENABLED
 
 CF_ASSUME_NONNULL_BEGIN
 
+/*
+ 注意：CGFloat在CGBase.h中定义，64位平台上是double（CGFLOAT_IS_DOUBLE为1），32位平台上是float，
+ 因此64位下一个CGRect占32字节。需要大量保存几何数据时，可以用float数组存放，只在调用CG函数时再转换为CGFloat，
+ 内存和带宽都减半；float有24位有效位，坐标在10000以内时误差约为0.001，对按点、按像素布局的数据足够。
+ 代码中需要区分两种情况时使用#if CGFLOAT_IS_DOUBLE判断，而不是判断sizeof或__LP64__。
+ */
+
 /* Points. */
 //定义一个点，设置x坐标和y坐标
 struct CGPoint {
@@ -255,6 +262,19 @@ CG_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
 CG_EXTERN bool CGRectIntersectsRect(CGRect rect1, CGRect rect2)
 CG_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
 
+/*
+ 注意：1、上面这些函数都是CG_EXTERN的外部函数，不会被内联，每次调用都要跨库调用并按值传递32字节的CGRect，
+ 函数内部还要处理宽高为负数的矩形，并单独判断CGRectNull（origin为+INFINITY、size为0）和CGRectInfinite，
+ 循环中逐个调用时编译器无法向量化。
+ 2、需要对成千上万个矩形做命中测试或相交判断时，可以预先剔除null矩形，用CGRectStandardize标准化，
+ 再把结果按minX[]、minY[]、maxX[]、maxY[]分成四个数组存放，循环体中既没有函数调用也没有特殊情况判断，
+ 只剩比较，编译器可以自动向量化：
+     for (size_t i = 0; i < n; i++) {
+         hit[i] = minX[i] <= p.x && p.x < maxX[i] && minY[i] <= p.y && p.y < maxY[i];
+     }
+ 这里的比较方式与CGRectContainsPoint一致（包含最小边，不包含最大边）。
+ */
+
 /*** Persistent representations. ***/
 
 /* Return a dictionary representation of `point'. */
@@ -102,6 +102,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+//64位平台上，数值能放进指针的NSNumber（例如较小的整数）会以标记指针的形式返回，不分配内存，具体见objc/objc.h
 @interface NSNumber (NSNumberCreation)
 
 + (NSNumber *)numberWithChar:(char)value;
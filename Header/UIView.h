@@ -274,6 +274,8 @@ NS_CLASS_AVAILABLE_IOS(2_0) @interface UIView : UIResponder <NSCoding, UIAppeara
     return hitView == self ? nil : hitView;
  }
  */
+// 注意：hitTest只会进入pointInside:返回YES（并且可见、userInteractionEnabled、alpha大于0.01）的视图，并从最上层的子视图往下查找，所以开销取决于路径上每一层兄弟视图的数量，而不是视图总数。
+// 同一个父视图下平铺几万个子视图时每次点击都是线性扫描；把相邻的子视图分组放进容器视图，相当于建立了一棵按区域划分的包围盒树，命中测试只需要沿一条路径向下查找。
 // 递归调用-pointInside:withEvent:.point是在接收者的坐标系中
 - (nullable UIView *)hitTest:(CGPoint)point withEvent:(nullable UIEvent *)event;   // recursively calls -pointInside:withEvent:. point is in the receiver's coordinate system
 // 这个函数的用处是判断当前的点击或者触摸事件的点是否在当前的view中
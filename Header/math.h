@@ -319,6 +319,20 @@ extern int __signbitl(long double);
  *                                                                            *
  ******************************************************************************/
 
+/*
+ 注意：1、下面的函数每次只计算一个值。sqrt、fabs、floor、ceil、trunc、fmin/fmax、copysign等函数编译器可以直接
+ 生成向量指令，但sin、cos、exp、log、pow、atan2等超越函数，没有向量数学库时编译器无法把逐个调用它们的循环向量化。
+ 2、需要对整个数组计算时，使用Accelerate框架vForce中的数组版本（#include <Accelerate/Accelerate.h>），
+ 参数依次为输出数组、输入数组和指向元素个数的指针，例如：
+     int n = count;
+     vvsin(y, x, &n);        //y[i] = sin(x[i])
+     vvatan2(z, y, x, &n);   //z[i] = atan2(y[i], x[i])
+     vvpow(z, y, x, &n);     //z[i] = pow(x[i], y[i])，注意指数在前
+ float版本为vvsinf等；NaN、Inf等特殊值按IEEE 754的规则处理，但精度（ulp）和非规格化数的处理不保证与这里的
+ 标量函数完全相同，对结果有严格要求时应当与标量函数逐个比较验证。
+ 3、也可以用clang的-fveclib=Accelerate选项，让编译器把循环中的sin、exp等调用自动替换为vForce的向量版本。
+ */
+
 extern float acosf(float);
 extern double acos(double);
 extern long double acosl(long double);
@@ -75,6 +75,19 @@ struct objc_super {
  *被调用前。
  */
 #if !OBJC_OLD_DISPATCH_PROTOTYPES
+/*
+ 消息发送流程：
+ 1、self为nil时直接返回0。
+ 2、通过isa找到类，在类的方法缓存（objc2中为cache_t，旧版为struct objc_cache）中按SEL散列查找，命中则直接跳转到IMP，这一步不加锁，
+ 只需要几条指令。
+ 3、缓存未命中时，加锁后先在本类的方法列表中查找，再沿父类链对每个父类先查它的方法缓存、再查它的方法列表，
+ 找到后写入本类的缓存再调用。
+ 4、仍然找不到时进入动态方法解析（+resolveInstanceMethod:）和消息转发（_objc_msgForward）。
+ 统计消息发送：运行时没有公开的采样接口。调试时可以声明私有函数
+ void instrumentObjcMessageSends(BOOL flag); 开启后每条消息都会以“+/- 接收者的类 实现方法的类 selector”的格式写入
+ /tmp/msgSends-<pid>，开启期间不填充方法缓存，开销很大，只适合短时间定位热点selector；
+ 线上统计应使用Instruments的Time Profiler采样，objc_msgSend的调用方即为热点。
+ */
 OBJC_EXPORT void objc_msgSend(void /* id self, SEL op, ... */ )
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 OBJC_EXPORT void objc_msgSendSuper(void /* struct objc_super *super, SEL op, ... */ )
@@ -379,6 +392,15 @@ OBJC_ARM64_UNAVAILABLE;
  *但可以与其他IMP值进行比较。
  */
 #if !OBJC_OLD_DISPATCH_PROTOTYPES
+/*
+ 注意：找不到方法时，运行时按下面的顺序处理，开销依次增大：
+ 1、+resolveInstanceMethod:/+resolveClassMethod:，在这里用class_addMethod为该selector添加实现
+ （可以是imp_implementationWithBlock生成的IMP），之后的调用会直接命中方法缓存，不再进入转发。
+ 2、-forwardingTargetForSelector:，返回另一个对象，相当于多一次objc_msgSend，不创建NSInvocation。
+ 3、-methodSignatureForSelector:和-forwardInvocation:，每次调用都要创建NSInvocation并拷贝全部参数，
+ 只有需要读取或修改参数、返回值时才使用。
+ 代理类中，已知的selector应当尽量在第1步或第2步处理，只把其余的留给forwardInvocation:。
+ */
 OBJC_EXPORT void _objc_msgForward(void /* id receiver, SEL sel, ... */ )
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 OBJC_EXPORT void _objc_msgForward_stret(void /* id receiver, SEL sel, ... */ )
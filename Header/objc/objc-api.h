@@ -112,6 +112,14 @@ __TVOS_AVAILABLE(t) __WATCHOS_AVAILABLE(w)
 
 /* OBJC_ISA_AVAILABILITY: `isa` will be deprecated or unavailable
  * in the future */
+/* OBJC_ISA_AVAILABILITY：`isa`将来会被弃用或不可用
+ *
+ * objc2在arm64等平台上使用non-pointer isa：isa不再只是类的地址，而是把类的地址（shiftcls）和
+ * 以下信息压缩在同一个64位字中：nonpointer、has_assoc（有关联对象）、has_cxx_dtor（有C++析构）、
+ * weakly_referenced（被弱引用过）、deallocating、has_sidetable_rc以及引用计数extra_rc。
+ * retain/release只需要对isa做一次原子的比较交换，extra_rc溢出时才把一半的计数转移到SideTable中。
+ * 因此不能再直接读取isa当作类来使用，应当调用object_getClass，它会去掉这些标记位。
+ */
 #if !defined(OBJC_ISA_AVAILABILITY)
 #   if __OBJC2__
 #       define OBJC_ISA_AVAILABILITY  __attribute__((deprecated))
@@ -201,6 +201,7 @@ OBJC_GC_DEPRECATED("use a simple assignment instead")
 static OBJC_INLINE id objc_assign_ivar(id val, id dest, ptrdiff_t offset)
 { return (*(id*)((char *)dest+offset) = val); }
 
+// 非GC环境下只是普通的读写，不会自动置nil，需要自动置nil的弱引用请使用__weak（objc_loadWeak/objc_storeWeak）
 OBJC_GC_DEPRECATED("use a simple read instead, or convert to zeroing __weak")
 static OBJC_INLINE id objc_read_weak(id *location)
 { return *location; }
@@ -83,6 +83,18 @@ typedef void (*objc_exception_handler)(id unused, void *context);
  *
  * @param exception The exception to be thrown.
  */
+/**
+ *抛出一个运行时异常。编译器会在\ c @throw的位置插入对这个函数的调用。
+ *
+ * @param exception要抛出的异常。
+ */
+/*
+ 注意：1、objc2的异常基于C++的零开销异常模型实现，进入@try不需要任何开销，
+ 开销全部集中在抛出时：分配异常对象、查找每一层栈帧的展开信息并做两遍栈展开，
+ 单次抛出的开销在微秒量级，并随调用栈深度增加。
+ 2、因此异常只适合处理程序错误，解析器等需要频繁报告失败的代码应当通过返回值或NSError报告错误，
+ 而不是每秒抛出成千上万个异常。
+ */
 OBJC_EXPORT void objc_exception_throw(id exception)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 OBJC_EXPORT void objc_exception_rethrow(void)
@@ -102,6 +114,7 @@ OBJC_EXPORT objc_uncaught_exception_handler objc_setUncaughtExceptionHandler(obj
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
 // Not for iOS.
+//不适用于iOS，只在macOS上可用
 OBJC_EXPORT uintptr_t objc_addExceptionHandler(objc_exception_handler fn, void *context)
 __OSX_AVAILABLE(10.5)
 __IOS_UNAVAILABLE __TVOS_UNAVAILABLE __WATCHOS_UNAVAILABLE;
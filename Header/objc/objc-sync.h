@@ -35,6 +35,24 @@
  *
  * @return OBJC_SYNC_SUCCESS once lock is acquired.
  */
+/**
+ *开始在'obj'上同步。
+ *需要时分配与'obj'关联的递归pthread_mutex。
+ *
+ * @param obj要开始同步的对象。
+ *
+ * @return 获得锁后返回OBJC_SYNC_SUCCESS。
+ */
+/*
+ 注意：1、@synchronized(obj){}会被编译成objc_sync_enter(obj)和objc_sync_exit(obj)。
+ 2、运行时用obj的地址散列到一组固定数量的分片（StripedMap，iOS真机上为8个，其他平台64个），
+ 每个分片有独立的自旋锁和一个SyncData链表，不同对象大多落在不同分片上，互不影响。
+ 3、每个线程会把最近持有的SyncData缓存在线程本地存储里，同一线程重复进入同一个对象的锁时
+ 不需要访问全局分片，只增加计数。
+ 4、真正的互斥是SyncData里的递归锁，竞争激烈时线程会休眠等待；如果profile中@synchronized
+ 占比很高，说明是同一个对象被多线程争用，应当缩小临界区或换用更细粒度的锁，而不是指望运行时优化。
+ 5、obj为nil时不加任何锁，等同于没有同步。
+ */
 OBJC_EXPORT  int objc_sync_enter(id obj)
 OBJC_AVAILABLE(10.3, 2.0, 9.0, 1.0);
 
@@ -45,10 +63,18 @@ OBJC_AVAILABLE(10.3, 2.0, 9.0, 1.0);
  *
  * @return OBJC_SYNC_SUCCESS or OBJC_SYNC_NOT_OWNING_THREAD_ERROR
  */
+/**
+ *结束在'obj'上同步。
+ *
+ * @param obj要结束同步的对象。
+ *
+ * @return OBJC_SYNC_SUCCESS或OBJC_SYNC_NOT_OWNING_THREAD_ERROR（当前线程没有持有这个锁）
+ */
 OBJC_EXPORT  int objc_sync_exit(id obj)
 OBJC_AVAILABLE(10.3, 2.0, 9.0, 1.0);
 
 // The wait/notify functions have never worked correctly and no longer exist.
+//wait/notify函数从未正常工作过，已经不存在了。
 OBJC_EXPORT  int objc_sync_wait(id obj, long long milliSecondsMaxWait)
 UNAVAILABLE_ATTRIBUTE;
 OBJC_EXPORT  int objc_sync_notify(id obj)
@@ -40,6 +40,13 @@ typedef struct objc_class *Class;
 
 /// Represents an instance of a class.
 ///表示类的一个实例。
+/*
+ 注意：64位平台上id不一定指向真正的objc_object，运行时使用标记指针（tagged pointer）：
+ 指针的最高位（iOS）或最低位（macOS）为1时，其余的位直接保存类的编号和值，
+ 较小的NSNumber、较短的ASCII字符串NSString、NSDate等都不需要分配内存。
+ objc_msgSend、object_getClass和retain/release会先检查标记位，对这类对象不做内存管理，
+ 所以不要直接访问obj->isa，应当使用object_getClass(obj)。
+ */
 struct objc_object {
     Class isa  OBJC_ISA_AVAILABILITY;
 };
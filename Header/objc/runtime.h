@@ -125,6 +125,7 @@ typedef struct {
  *
  * @return \ e obj的副本。
  */
+//内部先按size整体拷贝内存；只有类中有ARC编译的ivar时，才会再根据class_getIvarLayout/class_getWeakIvarLayout修正strong和weak的ivar，MRC的类只是普通的内存拷贝，不会retain任何ivar
 OBJC_EXPORT id object_copy(id obj, size_t size)
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0)
 OBJC_ARC_UNAVAILABLE;
@@ -561,6 +562,15 @@ OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
  *
  * @see objc_getClassList
  */
+/*
+ 注意：1、这个函数和objc_getClassList会返回进程中所有镜像（包括系统framework）的类，通常有上万个，
+ 并且会让运行时把它们全部实现（realize），这才是启动时遍历所有类耗时的主要原因。
+ 2、只需要自己代码中的类时，先用objc_copyClassNamesForImage取得指定镜像（如主程序）中的类名，
+ 再用objc_getClass逐个获取，只会实现真正用到的类。
+ 3、class_copyIvarList、class_copyMethodList、class_copyPropertyList、class_copyProtocolList
+ 返回的数组需要free，但数组中的Ivar、Method、objc_property_t以及名字字符串归运行时所有，在类存在期间一直有效，
+ 可以在第一次遍历时按Class缓存需要的信息，之后不必重复拷贝；由于地址随每次启动变化，跨进程缓存只能保存名字。
+ */
 OBJC_EXPORT Class *objc_copyClassList(unsigned int *outCount)
 OBJC_AVAILABLE(10.7, 3.1, 9.0, 1.0);
 
@@ -818,6 +828,14 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @note此函数搜索超类的实现，而\ c class_copyMethodList不。
  */
+/*
+ 注意：1、objc2中objc_class里的methodLists链表已经不再使用，类实现时编译器生成的方法列表会按selector地址排序，
+ 查找时不看列表长度：已经整理（fixed up）并且元素大小符合预期的列表都用二分查找，
+ 只有未整理或元素大小不同的列表才逐个线性查找。
+ 2、category的方法列表不会和原类的合并成一个数组，而是作为独立的列表插到前面，查找时依次在每个列表中二分，
+ 所以category中的同名方法会先被找到，这也是category能“覆盖”原方法的原因。
+ 3、这个函数不经过方法缓存，并且找不到时还会沿父类链继续查找；class_respondsToSelector则会使用方法缓存。
+ */
 OBJC_EXPORT Method class_getInstanceMethod(Class cls, SEL name)
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 
@@ -989,6 +1007,14 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @note你应该通常使用NSObject的conformsToProtocol：方法而不是这个函数。
  */
+/*
+ 注意：1、这个函数只检查cls本身声明的协议（包括这些协议继承的协议），不检查父类；
+ NSObject的+conformsToProtocol:会沿着父类链逐个调用它。
+ 2、运行时不缓存结果，每次都在加锁的情况下遍历协议列表并递归检查继承的协议（protocol_conformsToProtocol），
+ 协议不仅比较指针还会比较名字。
+ 3、依赖注入容器等需要在启动时反复查询的场景，应当自己以(Class, Protocol)为key缓存结果；
+ 只有调用class_addProtocol或protocol_addProtocol时结果才会改变，此时清空缓存即可。
+ */
 OBJC_EXPORT BOOL class_conformsToProtocol(Class cls, Protocol *protocol)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -1087,6 +1113,15 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @return \ e cls的\ c Ivar布局的描述。
  */
+/*
+ 注意：1、布局是一个以0x00结尾的字节串，按指针大小的字为单位描述本类自己声明的ivar：每个字节的高4位表示
+ 接下来有几个不需要处理的字（普通数据或非strong的指针），低4位表示随后有几个strong的对象指针。
+ 例如{0x01, 0x21, 0x00}表示：第1个字是strong，然后跳过2个字，再有1个strong。
+ 2、class_getWeakIvarLayout返回的__weak ivar布局使用同样的格式。
+ 3、object_copy先整体memcpy；如果类中有ARC编译的ivar，再按这两个布局对strong的字retain、对weak的字重新登记弱引用，
+ 连续的普通数据不会逐个字段处理，所以模型对象把标量ivar放在一起声明可以让布局更短。
+ MRC编译的类只做内存拷贝，不会retain其中的对象指针，需要调用者自己处理。
+ */
 OBJC_EXPORT const uint8_t *class_getIvarLayout(Class cls)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -1387,6 +1422,20 @@ OBJC_ARC_UNAVAILABLE;
  *
  * @see class_createInstance
  */
+/*
+ 注意：1、class_createInstance内部用calloc分配class_getInstanceSize(cls) + extraBytes字节（至少向上取整到16字节），
+ 再做与这个函数相同的初始化（设置isa、调用C++构造函数），但并不调用这个函数，所以所有对象都来自通用的堆。
+ 2、objc_constructInstance和objc_destructInstance把对象的初始化/销毁与内存的分配/释放分开，
+ 需要为某些频繁创建的类使用自己的内存池时，可以这样使用（仅MRC）：
+     size_t size = class_getInstanceSize(cls);
+     void *bytes = calloc(1, size);   //或者从按size分组的空闲链表中取出一块并清零
+     id obj = objc_constructInstance(cls, bytes);
+     ...
+     objc_destructInstance(obj);      //调用C++析构函数，清除关联对象和弱引用，但不释放内存
+     //把bytes放回按size分组的空闲链表，留给下一个对象使用
+ 3、内存必须正确对齐并且全部清零；这样创建的对象不能交给object_dispose（它会调用free释放内存），
+ 需要在类自己的释放流程中调用objc_destructInstance并回收内存。
+ */
 OBJC_EXPORT id objc_constructInstance(Class cls, void *bytes)
 OBJC_AVAILABLE(10.6, 3.0, 9.0, 1.0)
 OBJC_ARC_UNAVAILABLE;
@@ -1411,6 +1460,7 @@ OBJC_ARC_UNAVAILABLE;
  *
  * @note CF和其他客户端在GC下称之为“
  */
+//只销毁对象，不释放内存，返回的指针可以由调用者复用或释放
 OBJC_EXPORT void *objc_destructInstance(id obj)
 OBJC_AVAILABLE(10.6, 3.0, 9.0, 1.0)
 OBJC_ARC_UNAVAILABLE;
@@ -1454,6 +1504,14 @@ OBJC_ARC_UNAVAILABLE;
  * @note实例方法和实例变量应该添加到类本身。
  *类方法应该添加到元类。
  */
+/*
+ 注意：1、这个函数会分别为类和元类分配内存，之后每次class_addIvar、class_addMethod都可能再分配或扩大
+ ivar列表和方法列表，所以动态创建一个类需要多次堆分配。
+ 2、extraBytes分配的空间紧跟在类对象和元类对象之后，可以通过object_getIndexedIvars(cls)取得，
+ 需要给动态类附带少量数据时，放在这里比另外分配或使用关联对象更紧凑，并且会随objc_disposeClassPair一起释放。
+ 3、KVO、代理等需要动态子类的场景，应当先用objc_getClass(name)查找是否已经创建过同名的类并复用，
+ 而不是每次都创建再销毁，类一旦注册，后续的消息发送和方法缓存也都可以复用。
+ */
 OBJC_EXPORT Class objc_allocateClassPair(Class superclass, const char *name,
                                          size_t extraBytes)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
@@ -1500,6 +1558,7 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @warning如果此类或子类的实例存在，请不要调用。
  */
+//会一次性释放类、元类以及添加的ivar列表、方法列表和extraBytes空间
 OBJC_EXPORT void objc_disposeClassPair(Class cls)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -1559,6 +1618,15 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @返回一个C字符串。字符串可能为\ c NULL。
  */
+/*
+ 注意：1、返回的是编译器生成的类型编码字符串本身，不需要释放，例如-(void)setName:(NSString *)name
+ 的编码为"v24@0:8@16"：v是返回值类型void，24是参数总字节数，@0是self及其偏移，:8是_cmd，@16是name。
+ 2、下面的method_getNumberOfArguments、method_copyReturnType、method_copyArgumentType、
+ method_getArgumentType等函数每次调用都会重新解析这个字符串，copy系列还要分配内存。
+ 3、需要按参数逐个处理的转发、桥接代码，应当只解析一次，把结果保存下来复用，例如用
+ [NSMethodSignature signatureWithObjCTypes:method_getTypeEncoding(m)]生成签名对象并按Method缓存，
+ 之后通过numberOfArguments、getArgumentTypeAtIndex:、frameLength等获取信息。
+ */
 OBJC_EXPORT const char *method_getTypeEncoding(Method m)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -1576,6 +1644,7 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @return包含给定方法接受的参数数的整数。
  */
+//返回的参数个数包含隐藏参数self和_cmd，所以没有参数的方法返回2
 OBJC_EXPORT unsigned int method_getNumberOfArguments(Method m)
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 
@@ -1717,6 +1786,13 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  * method_setImplementation（m2，imp1）;
  * \ endcode
  */
+/*
+ 注意：1、method_exchangeImplementations、method_setImplementation以及替换已有方法的class_replaceMethod
+ 每次调用都要获取运行时的全局锁，并清空方法缓存（同一个Method可能被多个类共用，很多版本中会清空所有类的缓存），
+ 之后每个类的第一次消息发送都要重新走慢速查找。
+ 2、因此大量的方法交换应当集中在+load或启动最早期、缓存还几乎为空的时候一次完成，
+ 不要分散在运行过程中按需交换，否则每次交换都会让已经填充好的缓存全部失效。
+ */
 OBJC_EXPORT void method_exchangeImplementations(Method m1, Method m2)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -2315,6 +2391,15 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @return表示类名的C字符串数组。
  */
+/*
+ 注意：1、objc2中镜像加载时只把类按名字登记到全局表中，只有实现了+load的类（以及它们的父类）会被立即实现（realize），
+ 其余的类要等到第一次收到消息、调用objc_getClass或者被其他类引用时才会实现：
+ 这时才会整理方法列表、附加category、分配方法缓存。
+ 2、这个函数只读取镜像中的类名，不会实现这些类；而objc_copyClassList会实现所有类。
+ 3、调试时可以设置环境变量OBJC_PRINT_CLASS_SETUP=YES打印每个类的实现过程，
+ OBJC_PRINT_LOAD_METHODS=YES打印所有+load方法，从而统计有多少类在启动阶段被提前实现；
+ 减少+load的使用是让更多类保持延迟实现的主要手段。
+ */
 OBJC_EXPORT const char **objc_copyClassNamesForImage(const char *image,
                                                      unsigned int *outCount)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
@@ -2338,6 +2423,7 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  *
  * @return指示选择器名称的C字符串。
  */
+//SEL在苹果的实现中就是指向唯一化后方法名字符串的指针，因此这个函数只是直接返回，不加锁也不分配内存
 OBJC_EXPORT const char *sel_getName(SEL sel)
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 
@@ -2366,6 +2452,13 @@ OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
  *方法的选择器，然后可以将方法添加到类定义。如果方法名称
  *已经被注册，这个功能只是返回选择器。
  */
+/*
+ 注意：1、所有选择器都保存在一张全局的散列表中，同名的方法名只会保存一份，这样SEL之间才能直接比较地址。
+ 2、代码中用@selector()引用的选择器在镜像加载时已经由运行时批量注册并修正好，系统共享缓存中的选择器
+ 甚至是预先计算好的，运行时调用时不会再访问这张表。
+ 3、已注册的名字再次调用只是一次读锁下的散列查找；第一次注册才会加写锁并把字符串拷贝进表里。
+ 4、在频繁执行的代码中不要重复调用这个函数，把结果保存在static变量里，或者直接使用@selector()。
+ */
 OBJC_EXPORT SEL sel_registerName(const char *str)
 OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
 
@@ -2389,6 +2482,7 @@ OBJC_AVAILABLE(10.0, 2.0, 9.0, 1.0);
  *
  * @note sel_isEqual等效于==。
  */
+//由于选择器是唯一化的，这里只比较指针，开销和==相同
 OBJC_EXPORT BOOL sel_isEqual(SEL lhs, SEL rhs)
 OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
 
@@ -2474,6 +2568,15 @@ OBJC_AVAILABLE(10.5, 2.0, 9.0, 1.0);
  * @return调用此块的IMP。必须处理
  * \ c imp_removeBlock。
  */
+/*
+ 注意：1、返回的IMP是一小段跳板代码，运行时一次映射一对内存页（一页可执行的跳板代码模板和一页数据），
+ 一对页面可以提供几百个跳板，每个跳板在数据页的相同偏移处保存对应的block。
+ imp_getBlock和imp_removeBlock需要先获取跳板锁，再沿着页面对的链表逐个查找包含这个IMP的页面，
+ 找到页面后才通过地址计算得到对应的位置，所以页面越多查找越慢，并且所有线程会在这个锁上串行。
+ 2、imp_removeBlock会release这个block并把跳板放回空闲链表，下次创建时直接复用，
+ 只有全部跳板都用完时才会再映射新的页面，频繁创建和销毁不会每次都调用mmap。
+ 3、block会被Block_copy，不再使用的IMP一定要调用imp_removeBlock，否则block和其捕获的对象都不会被释放。
+ */
 OBJC_EXPORT IMP imp_implementationWithBlock(id block)
 OBJC_AVAILABLE(10.7, 4.3, 9.0, 1.0);
 
@@ -2539,6 +2642,14 @@ OBJC_AVAILABLE(10.7, 4.3, 9.0, 1.0);
  *
  * @return \ e位置指向的对象，如果\ e位置为\ c，则为\ c nil。
  */
+/*
+ 注意：1、弱引用保存在SideTable中：运行时用对象地址散列到一组分片的SideTable（StripedMap），每个分片有自己的
+ 自旋锁，其中的weak_table以被引用对象为key，记录所有指向它的__weak变量的地址。
+ 2、每个对象的弱引用地址先存放在一个4个元素的内联数组中，超过4个才换成单独分配的散列表。
+ 3、读取时只需要锁住该对象所在的那一个分片，不存在全局锁；读出的对象会被retain并autorelease，
+ 因此在循环里反复读取同一个__weak变量时，应当先用一个__strong局部变量保存一次。
+ 4、对象dealloc时（isa中带有弱引用标记的对象）会在一次加锁中把所有指向它的弱引用置为nil，然后从weak_table中删除该项。
+ */
 OBJC_EXPORT id objc_loadWeak(id *location)
 OBJC_AVAILABLE(10.7, 5.0, 9.0, 1.0);
 
@@ -2560,6 +2671,11 @@ OBJC_AVAILABLE(10.7, 5.0, 9.0, 1.0);
  *
  * @return存储到\ e位置的值，即\ e obj
  */
+/*
+ 注意：赋值时需要同时锁住旧对象和新对象所在的两个SideTable分片，从旧对象的弱引用表中删除location，
+ 再登记到新对象的弱引用表中，所以频繁给__weak变量赋值比给普通变量赋值的开销大得多，
+ 例如MBProgressHUD中的graceTimer等weak属性，只在创建定时器时赋值一次。
+ */
 OBJC_EXPORT id objc_storeWeak(id *location, id obj)
 OBJC_AVAILABLE(10.7, 5.0, 9.0, 1.0);
 
@@ -2615,6 +2731,15 @@ typedef OBJC_ENUM(uintptr_t, objc_AssociationPolicy) {
  * @see objc_setAssociatedObject
  * @see objc_removeAssociatedObjects
  */
+/*
+ 注意：1、关联对象并不保存在对象本身里，而是保存在运行时的一张全局表中：以对象地址为key找到该对象的
+ ObjectAssociationMap，再以key找到(policy, value)，整张全局表由一个锁保护。
+ 2、key只比较地址，通常使用static char变量的地址或者@selector(getter方法)作为key。
+ 3、第一次设置关联对象时会在isa中标记该对象有关联对象，对象dealloc时只有带这个标记的对象才会去全局表中
+ 查找并清除关联，没有用过关联对象的对象不需要访问这张表。
+ 4、policy的低位决定setter的行为（0不持有、1 retain、3 copy），高位01400决定getter是否在返回前
+ retain并autorelease，因此原子性的OBJC_ASSOCIATION_RETAIN在每次读取时都多一次retain/autorelease。
+ */
 OBJC_EXPORT void objc_setAssociatedObject(id object, const void *key, id value, objc_AssociationPolicy policy)
 OBJC_AVAILABLE(10.6, 3.1, 9.0, 1.0);
 
@@ -2638,6 +2763,10 @@ OBJC_AVAILABLE(10.6, 3.1, 9.0, 1.0);
  *
  * @see objc_setAssociatedObject
  */
+/*
+ 注意：每次调用都要获取全局关联表的锁并做两次散列查找，在高频读取、多线程读取的代码中，
+ 应当把结果缓存到局部变量中；不需要原子性时使用_NONATOMIC的policy，可以省掉读取时的retain/autorelease。
+ */
 OBJC_EXPORT id objc_getAssociatedObject(id object, const void *key)
 OBJC_AVAILABLE(10.6, 3.1, 9.0, 1.0);
 
@@ -2822,6 +2951,22 @@ struct objc_symtab {
 
 typedef struct objc_cache *Cache                             OBJC2_UNAVAILABLE;
 
+//方法缓存，每个类一份，是objc_msgSend快速路径查找的结构
+/*
+ 注意：1、缓存是一张以SEL为key的开放寻址散列表，CACHE_HASH(sel, mask)把SEL地址右移2位（32位）或3位（64位）
+ 后再与mask按位与，作为起始下标，冲突时线性探测下一个bucket，直到命中或遇到空bucket（未命中）。
+ 2、命中时objc_msgSend不加任何锁直接跳转到IMP；未命中才进入慢速路径，在methodLists和父类中查找，
+ 找到后在加锁的情况下写回缓存。
+ 3、在这个结构所属的旧版运行时中，缓存满了以后并不总是扩容：CLS_GROW_CACHE是“慢速增长”标记，
+ 满了的缓存在清空和扩容为原来的2倍之间交替进行。objc2的cache_t则在占用超过3/4时扩容为2倍，
+ 扩容时直接丢弃旧内容重新填充。两者的旧buckets都不会立即释放，而是等到确认没有线程还在读取旧表时再回收，
+ 因此并发读取的线程始终是安全的。
+ 4、class_addMethod、class_replaceMethod以及加载category会清空该类及其子类的缓存（即_objc_flush_caches(cls)）；
+ method_exchangeImplementations和method_setImplementation的参数只有Method，无法确定是哪个类，
+ 因此会清空所有类的缓存（_objc_flush_caches(nil)），新旧运行时都是如此。之后的第一次调用会重新走慢速路径。
+ 5、objc2中这个结构被cache_t（_buckets/_mask/_occupied）取代，但原理相同。
+ */
+
 #define CACHE_BUCKET_NAME(B)  ((B)->method_name)
 #define CACHE_BUCKET_IMP(B)   ((B)->method_imp)
 #define CACHE_BUCKET_VALID(B) (B)
@@ -2866,6 +3011,7 @@ __OSX_DEPRECATED(10.0, 10.5, "use class_respondsToSelector instead")
 __IOS_DEPRECATED(2.0, 2.0, "use class_respondsToSelector instead")
 __TVOS_DEPRECATED(9.0, 9.0, "use class_respondsToSelector instead")
 __WATCHOS_DEPRECATED(1.0, 1.0, "use class_respondsToSelector instead");
+//清空cls及其所有子类的方法缓存，运行时在修改方法列表时会自动调用，一般不需要手动调用
 OBJC_EXPORT void _objc_flush_caches(Class cls)
 __OSX_DEPRECATED(10.0, 10.5, "not recommended")
 __IOS_DEPRECATED(2.0, 2.0, "not recommended")